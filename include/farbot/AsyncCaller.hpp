@@ -4,6 +4,11 @@
 
 namespace farbot
 {
+namespace detail { struct async_caller_lambda { std::function<void()> fn; }; }
+
+// see the NOTE on callAsync: the realtime-safety of moving the lambdas is up to the caller
+template <> struct fifo_allows_non_realtime_moves<detail::async_caller_lambda> : std::true_type {};
+
 /** AsyncCaller
  * 
  *  Dispatches lambdas on a non-realtime thread. If caller_concurrency is 
@@ -33,7 +38,7 @@ public:
      */
     bool callAsync (std::function<void()> && lambda)
     {
-        return ringbuffer.push (std::move (lambda));
+        return ringbuffer.push (detail::async_caller_lambda {std::move (lambda)});
     }
 
     /** Process all the lambdas that have been deferred with callAsync
@@ -49,19 +54,19 @@ public:
     bool process()
     {
         auto didProcess = false;
-        std::function<void()> lambda;
+        detail::async_caller_lambda lambda;
 
         while (ringbuffer.pop (lambda))
         {
             didProcess = true;
 
-            if (lambda)
-                lambda();
+            if (lambda.fn)
+                lambda.fn();
         }
 
         return didProcess;
     }
 private:
-    fifo<std::function<void()>, fifo_options::concurrency::single, caller_concurrency> ringbuffer;
+    fifo<detail::async_caller_lambda, fifo_options::concurrency::single, caller_concurrency> ringbuffer;
 };
 }
\ No newline at end of file
@@ -4,9 +4,12 @@ namespace farbot
 {
 namespace detail
 {
-template <typename T, bool isWrite, bool swap_when_read> struct fifo_manip { static void access (T && slot, T&& arg) { slot = std::move (arg); } };
+// The return-default consumer moves the element out and resets the slot so that an underrun
+// yields a default constructed value. This is done for every T without a swap: push_or_pop is
+// noexcept, so swapping would not add any exception safety, only extra moves.
+template <typename T, bool isWrite, bool reset_when_read> struct fifo_manip { static void access (T && slot, T&& arg) { slot = std::move (arg); } };
 template <typename T> struct fifo_manip<T, false, false>     { static void access (T && slot, T&& arg) { arg = std::move (slot); } };
-template <typename T> struct fifo_manip<T, false, true>     { static void access (T && slot, T&& arg)  { arg = T(); std::swap (slot, arg); } };
+template <typename T> struct fifo_manip<T, false, true>      { static void access (T && slot, T&& arg) { arg = std::move (slot); slot = T(); } };
 
 struct thread_info
 {
@@ -3,6 +3,7 @@
 #include <atomic>
 #include <cassert>
 #include <thread>
+#include "RealtimeTraits.hpp"
 
 namespace farbot
 {
@@ -27,6 +28,11 @@ enum class full_empty_failure_mode
 };
 }
 
+// The fifo moves elements in and out of its slots on the realtime thread, so by default it only
+// accepts element types which are realtime move assignable (see RealtimeTraits.hpp). Specialise
+// this to std::true_type to opt out of this check for a particular element type.
+template <typename T> struct fifo_allows_non_realtime_moves : std::false_type {};
+
 // multiple consumer, multiple producer
 template <typename T,
           fifo_options::concurrency consumer_concurrency = fifo_options::concurrency::multiple,
@@ -36,6 +42,9 @@ template <typename T,
           std::size_t MAX_THREADS = 64>
 class fifo
 {
+    static_assert (is_realtime_move_assignable<T>::value || fifo_allows_non_realtime_moves<T>::value,
+                   "moving T is not realtime-safe: specialise fifo_allows_non_realtime_moves<T> to opt out");
+
 public:
     fifo (int capacity);
 
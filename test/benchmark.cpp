@@ -0,0 +1,140 @@
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "farbot/fifo.hpp"
+
+// Single-threaded push+pop microbenchmarks for the fifo. The return-default consumer is run
+// with both the current and the previous, swap-based, slot transfer. This target is not part of the
+// default build as the Debug configuration enables sanitizers. Build and run it in Release:
+//
+//   cmake -S . -B build -DCMAKE_BUILD_TYPE=Release
+//   cmake --build build --target fifo_benchmark && ./build/fifo_benchmark
+
+struct SmallMessage
+{
+    std::uint32_t type;
+    float value;
+};
+
+struct LargeMessage
+{
+    std::uint32_t type;
+    std::array<float, 64> payload;
+};
+
+using OwnedMessage = std::unique_ptr<LargeMessage>;
+
+namespace farbot
+{
+template <> struct fifo_allows_non_realtime_moves<OwnedMessage> : std::true_type {};
+}
+
+static volatile unsigned char sink;
+
+template <typename T>
+void do_not_optimize (T const& value)
+{
+    sink = *reinterpret_cast<const unsigned char*> (&value);
+}
+
+void check (bool success, const char* what)
+{
+    if (! success)
+    {
+        std::fprintf (stderr, "fifo_benchmark: unexpected failed %s\n", what);
+        std::abort();
+    }
+}
+
+// Wrapping an element in swap_transfer makes the return-default consumer use the swap-based
+// transfer which it used before it moved the element out and reset the slot. This allows
+// comparing both transfers with the same fifo.
+template <typename T> struct swap_transfer { T value; };
+
+namespace farbot
+{
+template <typename T> struct fifo_allows_non_realtime_moves<swap_transfer<T>> : std::true_type {};
+
+namespace detail
+{
+template <typename T> struct fifo_manip<swap_transfer<T>, false, true>
+{
+    static void access (swap_transfer<T> && slot, swap_transfer<T> && arg) { arg = swap_transfer<T>(); std::swap (slot, arg); }
+};
+}
+}
+
+constexpr int pool_size = 1024;
+constexpr int num_iterations = 20000;
+
+// Messages are created once up front and then passed back and forth so that the timed loop
+// only contains the push and pop (and, for OwnedMessage, real ownership transfers).
+template <typename T, typename Factory>
+std::vector<T> make_pool (Factory&& make)
+{
+    std::vector<T> pool;
+    pool.reserve (pool_size);
+
+    for (int i = 0; i < pool_size; ++i)
+        pool.push_back (T {make()});
+
+    return pool;
+}
+
+template <typename T, farbot::fifo_options::full_empty_failure_mode consumer_failure_mode, typename Factory>
+void run_fifo_benchmark (const char* name, Factory&& make)
+{
+    farbot::fifo<T,
+                 farbot::fifo_options::concurrency::single,
+                 farbot::fifo_options::concurrency::single,
+                 consumer_failure_mode> fifo (pool_size);
+
+    auto pool = make_pool<T> (make);
+    auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < num_iterations; ++i)
+    {
+        for (auto& message : pool)
+            check (fifo.push (std::move (message)), "push");
+
+        for (auto& message : pool)
+        {
+            check (fifo.pop (message), "pop");
+            do_not_optimize (message);
+        }
+    }
+
+    auto elapsed = std::chrono::duration<double, std::nano> (std::chrono::steady_clock::now() - start);
+    std::printf ("%-56s %8.2f ns/push+pop\n", name, elapsed.count() / (double (num_iterations) * pool_size));
+}
+
+template <typename T, typename Factory>
+void run_message_benchmarks (const char* name, Factory&& make)
+{
+    using farbot::fifo_options::full_empty_failure_mode;
+    std::string prefix (name);
+
+    run_fifo_benchmark<T, full_empty_failure_mode::return_false_on_full_or_empty>             ((prefix + "/return_false_on_full_or_empty").c_str(), make);
+    run_fifo_benchmark<swap_transfer<T>, full_empty_failure_mode::overwrite_or_return_default> ((prefix + "/overwrite_or_return_default/swap").c_str(), make);
+    run_fifo_benchmark<T, full_empty_failure_mode::overwrite_or_return_default>               ((prefix + "/overwrite_or_return_default/move_reset").c_str(), make);
+}
+
+int main()
+{
+   #ifndef NDEBUG
+    std::printf ("WARNING: fifo_benchmark was built without NDEBUG, the numbers below are not meaningful\n");
+   #endif
+
+    run_message_benchmarks<SmallMessage> ("SmallMessage", [] () { return SmallMessage {1, 0.5f}; });
+    run_message_benchmarks<LargeMessage> ("LargeMessage", [] () { return LargeMessage {1, {}}; });
+    run_message_benchmarks<OwnedMessage> ("OwnedMessage", [] () { return std::make_unique<LargeMessage>(); });
+
+    return 0;
+}
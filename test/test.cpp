@@ -2,6 +2,8 @@
 #include <atomic>
 #include <random>
 #include <array>
+#include <memory>
+#include <string>
 #include <unordered_set>
 
 #include <mutex>
@@ -19,6 +21,53 @@ static_assert (farbot::is_realtime_move_assignable<TestData>::value);
 // ensure that the object could be torn
 static_assert(! std::atomic<TestData>::is_always_lock_free);
 
+// the fifo rejects element types with non-realtime moves...
+static_assert (! farbot::is_realtime_move_assignable<std::string>::value);
+
+// ...and AsyncCaller must not opt std::function out of this check for everyone else
+static_assert (! farbot::fifo_allows_non_realtime_moves<std::function<void()>>::value);
+
+struct MoveOnlyData
+{
+    int x = 0;
+
+    MoveOnlyData() = default;
+    MoveOnlyData (int num) : x (num) {}
+    MoveOnlyData (MoveOnlyData&&) = default;
+    MoveOnlyData& operator= (const MoveOnlyData&) = delete;
+    MoveOnlyData& operator= (MoveOnlyData&&) = default;
+};
+
+struct ThrowingMoveData
+{
+    int x = 0;
+
+    ThrowingMoveData() = default;
+    ThrowingMoveData (int num) : x (num) {}
+    ThrowingMoveData (ThrowingMoveData&&) = default;
+    ThrowingMoveData& operator= (ThrowingMoveData&& o) noexcept (false) { x = o.x; return *this; }
+};
+
+struct CountingData
+{
+    static inline int default_constructions = 0, move_constructions = 0, move_assignments = 0;
+    static void reset_counts() { default_constructions = move_constructions = move_assignments = 0; }
+
+    int x = 0;
+
+    CountingData() noexcept { ++default_constructions; }
+    CountingData (int num) noexcept : x (num) {}
+    CountingData (CountingData&& o) noexcept : x (o.x) { ++move_constructions; }
+    CountingData& operator= (CountingData&& o) noexcept { x = o.x; ++move_assignments; return *this; }
+};
+
+namespace farbot
+{
+template <> struct fifo_allows_non_realtime_moves<std::unique_ptr<int>> : std::true_type {};
+template <> struct fifo_allows_non_realtime_moves<ThrowingMoveData> : std::true_type {};
+template <> struct fifo_allows_non_realtime_moves<CountingData> : std::true_type {};
+}
+
 TestData create (int num)
 {
     return TestData {num, num, num, num, num, num, num, num};
@@ -226,6 +275,123 @@ TEST (fifo, multi_consumer_multi_producer)
     do_thread_test<10, 10, farbot::fifo_options::concurrency::multiple, farbot::fifo_options::concurrency::multiple>();
 }
 
+TEST (fifo, return_default_on_empty)
+{
+    farbot::fifo<TestData,
+                 farbot::fifo_options::concurrency::single,
+                 farbot::fifo_options::concurrency::single,
+                 farbot::fifo_options::full_empty_failure_mode::overwrite_or_return_default> fifo (4);
+
+    TestData test;
+
+    for (int i = 0; i < 4; ++i)
+        EXPECT_TRUE (fifo.push (create (i + 1)));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE (fifo.pop (test));
+        EXPECT_TRUE (test == (i + 1));
+    }
+
+    // the slot was reset when it was read so an underrun yields a default value
+    EXPECT_TRUE (fifo.pop (test));
+    EXPECT_TRUE (test == 0);
+}
+
+TEST (fifo, trivially_copyable_move_only)
+{
+    farbot::fifo<MoveOnlyData,
+                 farbot::fifo_options::concurrency::single,
+                 farbot::fifo_options::concurrency::single> fifo (4);
+
+    farbot::fifo<MoveOnlyData,
+                 farbot::fifo_options::concurrency::single,
+                 farbot::fifo_options::concurrency::single,
+                 farbot::fifo_options::full_empty_failure_mode::overwrite_or_return_default> default_fifo (4);
+
+    MoveOnlyData test;
+
+    EXPECT_TRUE (fifo.push (MoveOnlyData (7)));
+    EXPECT_TRUE (fifo.pop (test));
+    EXPECT_EQ (test.x, 7);
+
+    EXPECT_TRUE (default_fifo.push (MoveOnlyData (9)));
+    EXPECT_TRUE (default_fifo.pop (test));
+    EXPECT_EQ (test.x, 9);
+    EXPECT_TRUE (default_fifo.pop (test));
+    EXPECT_EQ (test.x, 0);
+}
+
+TEST (fifo, non_trivial_return_default_on_empty)
+{
+    farbot::fifo<std::unique_ptr<int>,
+                 farbot::fifo_options::concurrency::single,
+                 farbot::fifo_options::concurrency::single,
+                 farbot::fifo_options::full_empty_failure_mode::overwrite_or_return_default> fifo (4);
+
+    std::unique_ptr<int> test;
+
+    EXPECT_TRUE (fifo.push (std::make_unique<int> (42)));
+    EXPECT_TRUE (fifo.pop (test));
+    ASSERT_NE (test, nullptr);
+    EXPECT_EQ (*test, 42);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE (fifo.pop (test));
+        EXPECT_EQ (test, nullptr);
+    }
+}
+
+TEST (fifo, throwing_move_return_default_on_empty)
+{
+    farbot::fifo<ThrowingMoveData,
+                 farbot::fifo_options::concurrency::single,
+                 farbot::fifo_options::concurrency::single,
+                 farbot::fifo_options::full_empty_failure_mode::overwrite_or_return_default> fifo (4);
+
+    ThrowingMoveData test;
+
+    EXPECT_TRUE (fifo.push (ThrowingMoveData (5)));
+    EXPECT_TRUE (fifo.pop (test));
+    EXPECT_EQ (test.x, 5);
+    EXPECT_TRUE (fifo.pop (test));
+    EXPECT_EQ (test.x, 0);
+}
+
+TEST (fifo, slot_transfer_counts)
+{
+    farbot::fifo<CountingData,
+                 farbot::fifo_options::concurrency::single,
+                 farbot::fifo_options::concurrency::single> fifo (4);
+
+    farbot::fifo<CountingData,
+                 farbot::fifo_options::concurrency::single,
+                 farbot::fifo_options::concurrency::single,
+                 farbot::fifo_options::full_empty_failure_mode::overwrite_or_return_default> default_fifo (4);
+
+    CountingData test;
+
+    // push and pop are a single move assignment each
+    CountingData::reset_counts();
+    EXPECT_TRUE (fifo.push (CountingData (1)));
+    EXPECT_TRUE (fifo.pop (test));
+    EXPECT_EQ (test.x, 1);
+    EXPECT_EQ (CountingData::default_constructions, 0);
+    EXPECT_EQ (CountingData::move_constructions, 0);
+    EXPECT_EQ (CountingData::move_assignments, 2);
+
+    EXPECT_TRUE (default_fifo.push (CountingData (2)));
+
+    // the return-default pop moves the element out and resets the slot: no swap
+    CountingData::reset_counts();
+    EXPECT_TRUE (default_fifo.pop (test));
+    EXPECT_EQ (test.x, 2);
+    EXPECT_EQ (CountingData::default_constructions, 1);
+    EXPECT_EQ (CountingData::move_constructions, 0);
+    EXPECT_EQ (CountingData::move_assignments, 2);
+}
+
 TEST(fifo, async_caller_test)
 {
     std::mutex init_mutex;